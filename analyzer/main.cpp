@@ -0,0 +1,585 @@
+//
+//  main.cpp
+//  analyzer
+//
+
+// Command line tool for ranking boards by difficulty
+// Generates boards with the same placement and labelling code as the game (or loads them from a file)
+// and writes one CSV row of metrics per board
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <cstdint>
+#include "Cell.hpp"
+#include "Board.hpp"
+using namespace std;
+
+// Value of a packed cell containing a mine, other cells hold their number of adjacent mines
+const uint8_t MINE = 9;
+
+// Largest width or height accepted, keeps width * height * 8 well inside an int
+const int MAX_SIDE = 1000;
+
+// Board packed into one byte per cell, indexed by (x * height) + y like gameBoard[x][y]
+struct PackedBoard {
+    int width = 0;
+    int height = 0;
+    int numMines = 0;
+    vector<uint8_t> cells;
+};
+
+// Metrics written out for each board
+struct Metrics {
+    bool valid = false;
+    int width = 0;
+    int height = 0;
+    int numMines = 0;
+    // Minimum number of clicks needed to clear the board
+    int threeBV = 0;
+    // Connected regions of cells with no adjacent mines
+    int openings = 0;
+    // Connected groups of numbered cells that don't border an opening
+    int islands = 0;
+    // Times the solver got stuck and had to open a cell without proof that it was safe
+    int guesses = 0;
+};
+
+// Command line settings
+struct Options {
+    int width = 30;
+    int height = 16;
+    int numMines = 99;
+    long long count = 1000000;
+    unsigned long long seed = 1;
+    int threads = 0;
+    string inputPath;
+    string outputPath;
+};
+
+// Number of boards handed to the worker threads at once, results are written out between chunks
+const long long chunkSize = 65536;
+
+// Map of width, height and number of mines keyed by difficulty name, matching the game's settings
+map<string, vector<int>> settingsMap = {
+    {"beginner", {9, 9, 10}},
+    {"intermediate", {16, 16, 40}},
+    {"expert", {30, 16, 99}}
+};
+
+void printUsage() {
+    cerr << "Usage: analyzer [options]\n"
+         << "  -d <difficulty>  beginner, intermediate or expert (default expert)\n"
+         << "  -w <width> -h <height> -m <mines>  custom board size, up to 1000 by 1000\n"
+         << "  -n <count>       number of boards to generate (default 1000000)\n"
+         << "  -s <seed>        seed for board generation (default 1)\n"
+         << "  -i <file>        analyze boards from file instead of generating them\n"
+         << "                   one board per line: <width> <height> <cells>, cells given row by row\n"
+         << "                   with '*' for a mine and '.' for a safe cell\n"
+         << "  -o <file>        write CSV to file instead of standard output\n"
+         << "  -j <threads>     number of worker threads (default all cores)\n";
+}
+
+// Read command line arguments into options, returns false if they are invalid
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) { return false; }
+        string value = argv[++i];
+        try {
+            if (arg == "-d") {
+                if (settingsMap.find(value) == settingsMap.end()) { return false; }
+                options.width = settingsMap[value][0];
+                options.height = settingsMap[value][1];
+                options.numMines = settingsMap[value][2];
+            }
+            else if (arg == "-w") { options.width = stoi(value); }
+            else if (arg == "-h") { options.height = stoi(value); }
+            else if (arg == "-m") { options.numMines = stoi(value); }
+            else if (arg == "-n") { options.count = stoll(value); }
+            else if (arg == "-s") { options.seed = stoull(value); }
+            else if (arg == "-j") { options.threads = stoi(value); }
+            else if (arg == "-i") { options.inputPath = value; }
+            else if (arg == "-o") { options.outputPath = value; }
+            else { return false; }
+        }
+        catch (const exception&) {
+            return false;
+        }
+    }
+    return options.width > 0 && options.height > 0 && options.width <= MAX_SIDE && options.height <= MAX_SIDE
+        && options.numMines >= 0 && options.numMines < options.width * options.height && options.count >= 0;
+}
+
+// Copy a labelled board of Cell objects into a packed board
+void packBoard(vector<vector<Cell>>& board, int width, int height, int numMines, PackedBoard& out) {
+    out.width = width;
+    out.height = height;
+    out.numMines = numMines;
+    out.cells.resize(width * height);
+    for (int i = 0; i < width; i++) {
+        for (int j = 0; j < height; j++) {
+            out.cells[(i * height) + j] = board[i][j].getHasMine() ? MINE : board[i][j].getAdjacentNum();
+        }
+    }
+}
+
+// Make sure the scratch board can hold width x height cells and clear it
+void resetBoard(vector<vector<Cell>>& board, int width, int height) {
+    if (int(board.size()) < width) { board.resize(width); }
+    for (int i = 0; i < width; i++) {
+        if (int(board[i].size()) < height) { board[i].resize(height); }
+        for (int j = 0; j < height; j++) {
+            board[i][j].setHasMine(false);
+            board[i][j].setAdjacentNum(0);
+            board[i][j].setRow(i);
+            board[i][j].setCol(j);
+        }
+    }
+}
+
+// Generate board number index the same way initBoard() does
+// Each board has its own seed so the output doesn't depend on the number of threads
+void generateBoard(const Options& options, long long index, vector<vector<Cell>>& scratch, PackedBoard& out) {
+    seed_seq seq = {
+        static_cast<uint32_t>(options.seed), static_cast<uint32_t>(options.seed >> 32),
+        static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32)
+    };
+    mt19937 gen(seq);
+    resetBoard(scratch, options.width, options.height);
+    placeMines(scratch, options.width, options.height, options.numMines, gen);
+    labelCells(scratch, options.width, options.height);
+    packBoard(scratch, options.width, options.height, options.numMines, out);
+}
+
+// Parse a board from a line of the input file and label it, returns false if the line is malformed
+bool loadBoard(const string& line, vector<vector<Cell>>& scratch, PackedBoard& out) {
+    istringstream stream(line);
+    int width = 0;
+    int height = 0;
+    string cells;
+    if (!(stream >> width >> height >> cells) || width <= 0 || height <= 0
+        || width > MAX_SIDE || height > MAX_SIDE || cells.size() != size_t(width * height)
+        || cells.find_first_not_of("*.") != string::npos) {
+        return false;
+    }
+
+    resetBoard(scratch, width, height);
+    int numMines = 0;
+    for (int j = 0; j < height; j++) {
+        for (int i = 0; i < width; i++) {
+            if (cells[(j * width) + i] == '*') {
+                scratch[i][j].setHasMine(true);
+                numMines++;
+            }
+        }
+    }
+    labelCells(scratch, width, height);
+    packBoard(scratch, width, height, numMines, out);
+    return true;
+}
+
+// Neighbours of every cell for one board size, so they aren't recomputed on every lookup
+// The neighbours of cell i are cells[(i * 8)] to cells[(i * 8) + count[i] - 1]
+struct NeighbourTable {
+    int width = 0;
+    int height = 0;
+    vector<uint8_t> count;
+    vector<int> cells;
+
+    // Rebuild the table if the board size has changed
+    void build(int newWidth, int newHeight) {
+        if (newWidth == width && newHeight == height) { return; }
+        width = newWidth;
+        height = newHeight;
+        count.assign(width * height, 0);
+        cells.assign(width * height * 8, 0);
+        for (int x = 0; x < width; x++) {
+            for (int y = 0; y < height; y++) {
+                int i = (x * height) + y;
+                for (int dx = -1; dx <= 1; dx++) {
+                    for (int dy = -1; dy <= 1; dy++) {
+                        int nx = x + dx;
+                        int ny = y + dy;
+                        if ((dx != 0 || dy != 0) && nx >= 0 && nx < width && ny >= 0 && ny < height) {
+                            cells[(i * 8) + count[i]++] = (nx * height) + ny;
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+int findRoot(vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+// Work out 3BV, openings and islands by labelling connected components of the packed board
+// Cells are either part of an opening (no adjacent mines), an island (numbered and not touching an opening) or neither
+// A single pass joins every cell to the already visited neighbours of the same kind
+void labelComponents(const PackedBoard& board, const NeighbourTable& table, vector<int>& parent,
+                     vector<uint8_t>& kind, Metrics& metrics) {
+    int numCells = board.width * board.height;
+    parent.resize(numCells);
+    kind.assign(numCells, 0);
+
+    for (int i = 0; i < numCells; i++) {
+        if (board.cells[i] == 0) {
+            kind[i] = 1;
+        }
+        else if (board.cells[i] != MINE) {
+            kind[i] = 2;
+            const int* neighbours = &table.cells[i * 8];
+            for (int k = 0; k < table.count[i]; k++) {
+                if (board.cells[neighbours[k]] == 0) { kind[i] = 0; break; }
+            }
+        }
+    }
+
+    int isolated = 0;
+    for (int i = 0; i < numCells; i++) {
+        parent[i] = i;
+        if (kind[i] == 0) { continue; }
+        if (kind[i] == 2) { isolated++; }
+        int x = i / board.height;
+        int y = i % board.height;
+        // Neighbours already visited: the previous cell in this column and three in the previous column
+        int previous[4][2] = {{x, y - 1}, {x - 1, y - 1}, {x - 1, y}, {x - 1, y + 1}};
+        for (auto& [nx, ny] : previous) {
+            if (nx < 0 || ny < 0 || ny >= board.height) { continue; }
+            int n = (nx * board.height) + ny;
+            if (kind[n] == kind[i]) {
+                parent[findRoot(parent, i)] = findRoot(parent, n);
+            }
+        }
+    }
+
+    metrics.openings = 0;
+    metrics.islands = 0;
+    for (int i = 0; i < numCells; i++) {
+        if (kind[i] != 0 && findRoot(parent, i) == i) {
+            if (kind[i] == 1) { metrics.openings++; }
+            else { metrics.islands++; }
+        }
+    }
+    // One click per opening plus one per numbered cell that no opening uncovers
+    metrics.threeBV = metrics.openings + isolated;
+}
+
+// Buffers used by the solver, kept between boards so each thread reuses its own allocations
+struct SolverBuffers {
+    vector<uint8_t> state;
+    // Cells waiting to be opened by the flood fill
+    vector<int> stack;
+    // Numbers waiting for the single cell rule, and for the subset rule
+    vector<int> work;
+    vector<int> pairs;
+    vector<uint8_t> inWork;
+    vector<uint8_t> inPairs;
+};
+
+// Play the board with a solver that only opens or flags cells it can prove, counting how often it gets stuck
+// Uses the single cell rule (a number is satisfied or needs all its unknown neighbours) and the subset rule
+// (comparing two numbers whose unknown neighbours overlap). The first click is made on an opening if there is one
+// and isn't counted as a guess
+// Both rules are driven by work queues: a number is only re-examined when one of its neighbours changes,
+// and only numbers the single cell rule couldn't finish are paired up for the subset rule
+int countGuesses(const PackedBoard& board, const NeighbourTable& table, SolverBuffers& buffers) {
+    const uint8_t unknown = 0, opened = 1, flagged = 2;
+    int numCells = board.width * board.height;
+    int safeLeft = numCells - board.numMines;
+    vector<uint8_t>& state = buffers.state;
+    vector<int>& stack = buffers.stack;
+    vector<int>& work = buffers.work;
+    vector<int>& pairs = buffers.pairs;
+    vector<uint8_t>& inWork = buffers.inWork;
+    vector<uint8_t>& inPairs = buffers.inPairs;
+    state.assign(numCells, unknown);
+    inWork.assign(numCells, 0);
+    inPairs.assign(numCells, 0);
+    work.clear();
+    pairs.clear();
+
+    // Queue an opened number for the single cell rule
+    auto queue = [&](int i) {
+        if (state[i] == opened && board.cells[i] != 0 && !inWork[i]) {
+            inWork[i] = 1;
+            work.push_back(i);
+        }
+    };
+
+    // Queue a changed cell's opened numbers (and the cell itself)
+    auto touch = [&](int i) {
+        const int* neighbours = &table.cells[i * 8];
+        for (int k = 0; k < table.count[i]; k++) {
+            queue(neighbours[k]);
+        }
+        queue(i);
+    };
+
+    // Flag a cell known to hold a mine
+    auto flag = [&](int i) {
+        state[i] = flagged;
+        touch(i);
+    };
+
+    // Open a cell, flooding through cells with no adjacent mines
+    auto open = [&](int start) {
+        stack.clear();
+        stack.push_back(start);
+        while (!stack.empty()) {
+            int i = stack.back();
+            stack.pop_back();
+            if (state[i] != unknown) { continue; }
+            state[i] = opened;
+            safeLeft--;
+            touch(i);
+            if (board.cells[i] == 0) {
+                const int* neighbours = &table.cells[i * 8];
+                for (int k = 0; k < table.count[i]; k++) {
+                    if (state[neighbours[k]] == unknown) { stack.push_back(neighbours[k]); }
+                }
+            }
+        }
+    };
+
+    // Unknown neighbours of an opened number and the mines still to be found among them
+    auto frontier = [&](int i, int cells[8], int& remaining) {
+        const int* neighbours = &table.cells[i * 8];
+        int size = 0;
+        remaining = board.cells[i];
+        for (int k = 0; k < table.count[i]; k++) {
+            if (state[neighbours[k]] == unknown) { cells[size++] = neighbours[k]; }
+            else if (state[neighbours[k]] == flagged) { remaining--; }
+        }
+        return size;
+    };
+
+    // Subset rule, if all of A's unknown cells are next to B the rest of B's cells hold the difference
+    // Returns true if any cell was opened or flagged
+    auto subset = [&](const int cellsA[8], int sizeA, int remainingA, const int cellsB[8], int sizeB, int remainingB) {
+        if (sizeB <= sizeA) { return false; }
+        // Cells of B that aren't next to A
+        int rest[8];
+        int sizeRest = 0;
+        int shared = 0;
+        for (int k = 0; k < sizeB; k++) {
+            bool inA = false;
+            for (int l = 0; l < sizeA; l++) {
+                if (cellsA[l] == cellsB[k]) { inA = true; break; }
+            }
+            if (inA) { shared++; }
+            else { rest[sizeRest++] = cellsB[k]; }
+        }
+        if (shared != sizeA) { return false; }
+        if (remainingB == remainingA) {
+            for (int k = 0; k < sizeRest; k++) { open(rest[k]); }
+            return true;
+        }
+        if (remainingB - remainingA == sizeRest) {
+            for (int k = 0; k < sizeRest; k++) { flag(rest[k]); }
+            return true;
+        }
+        return false;
+    };
+
+    int firstClick = -1;
+    for (int i = 0; i < numCells && firstClick == -1; i++) {
+        if (board.cells[i] == 0) { firstClick = i; }
+    }
+    for (int i = 0; i < numCells && firstClick == -1; i++) {
+        if (board.cells[i] != MINE) { firstClick = i; }
+    }
+    if (firstClick == -1) { return 0; }
+    open(firstClick);
+
+    int guesses = 0;
+    int cellsA[8];
+    int cellsB[8];
+    while (safeLeft > 0) {
+        // Single cell rule, numbers it can't finish are kept for the subset rule
+        if (!work.empty()) {
+            int i = work.back();
+            work.pop_back();
+            inWork[i] = 0;
+            int remaining;
+            int size = frontier(i, cellsA, remaining);
+            if (size == 0) { continue; }
+            if (remaining == 0) {
+                for (int k = 0; k < size; k++) { open(cellsA[k]); }
+            }
+            else if (remaining == size) {
+                for (int k = 0; k < size; k++) { flag(cellsA[k]); }
+            }
+            else if (!inPairs[i]) {
+                inPairs[i] = 1;
+                pairs.push_back(i);
+            }
+            continue;
+        }
+
+        // Subset rule, pairing a number with every opened number close enough to share an unknown cell
+        if (!pairs.empty()) {
+            int a = pairs.back();
+            pairs.pop_back();
+            inPairs[a] = 0;
+            int remainingA;
+            int sizeA = frontier(a, cellsA, remainingA);
+            if (sizeA == 0) { continue; }
+            int ax = a / board.height;
+            int ay = a % board.height;
+            bool progress = false;
+            for (int bx = max(0, ax - 2); bx <= min(board.width - 1, ax + 2) && !progress; bx++) {
+                for (int by = max(0, ay - 2); by <= min(board.height - 1, ay + 2) && !progress; by++) {
+                    int b = (bx * board.height) + by;
+                    if (b == a || state[b] != opened || board.cells[b] == 0) { continue; }
+                    int remainingB;
+                    int sizeB = frontier(b, cellsB, remainingB);
+                    if (sizeB == 0) { continue; }
+                    progress = subset(cellsA, sizeA, remainingA, cellsB, sizeB, remainingB)
+                        || subset(cellsB, sizeB, remainingB, cellsA, sizeA, remainingA);
+                }
+            }
+            // The cells changed may have been a's own, so look at it again once the changes have been processed
+            if (progress && !inPairs[a]) {
+                inPairs[a] = 1;
+                pairs.push_back(a);
+            }
+            continue;
+        }
+
+        // Stuck, so open a safe cell without proof
+        guesses++;
+        for (int i = 0; i < numCells; i++) {
+            if (state[i] == unknown && board.cells[i] != MINE) {
+                open(i);
+                break;
+            }
+        }
+    }
+    return guesses;
+}
+
+// Compute every metric for one board
+// Buffers are passed in so that each thread reuses its own allocations
+struct Analyzer {
+    vector<vector<Cell>> scratch;
+    PackedBoard board;
+    NeighbourTable table;
+    vector<int> parent;
+    vector<uint8_t> kind;
+    SolverBuffers solver;
+
+    void analyze(Metrics& metrics) {
+        metrics.valid = true;
+        metrics.width = board.width;
+        metrics.height = board.height;
+        metrics.numMines = board.numMines;
+        table.build(board.width, board.height);
+        labelComponents(board, table, parent, kind, metrics);
+        metrics.guesses = countGuesses(board, table, solver);
+    }
+};
+
+// Append a row of metrics to the CSV buffer
+void writeRow(string& out, long long index, const Metrics& metrics) {
+    out += to_string(index) + "," + to_string(metrics.width) + "," + to_string(metrics.height) + ","
+        + to_string(metrics.numMines) + "," + to_string(metrics.threeBV) + "," + to_string(metrics.openings) + ","
+        + to_string(metrics.islands) + "," + to_string(metrics.guesses) + "\n";
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+    int numThreads = options.threads > 0 ? options.threads : max(1u, thread::hardware_concurrency());
+
+    ifstream inStream;
+    if (!options.inputPath.empty()) {
+        inStream.open(options.inputPath);
+        if (!inStream) {
+            cerr << "Could not open " << options.inputPath << "\n";
+            return 1;
+        }
+    }
+    ofstream outStream;
+    if (!options.outputPath.empty()) {
+        outStream.open(options.outputPath, ofstream::out | ofstream::trunc);
+        if (!outStream) {
+            cerr << "Could not open " << options.outputPath << "\n";
+            return 1;
+        }
+    }
+    ostream& out = options.outputPath.empty() ? cout : outStream;
+    out << "board,width,height,mines,3bv,openings,islands,guesses\n";
+
+    vector<Analyzer> analyzers(numThreads);
+    vector<Metrics> results(chunkSize);
+    vector<string> lines(chunkSize);
+    string buffer;
+    long long chunkStart = 0;
+    while (true) {
+        // Fill the next chunk, either from the input file or by counting up to the requested number of boards
+        long long size = 0;
+        if (!options.inputPath.empty()) {
+            while (size < chunkSize && getline(inStream, lines[size])) { size++; }
+        }
+        else {
+            size = min(chunkSize, options.count - chunkStart);
+        }
+        if (size <= 0) { break; }
+
+        // Threads take boards from the chunk in small batches until none are left
+        atomic<long long> next(0);
+        vector<thread> workers;
+        for (int t = 0; t < numThreads; t++) {
+            workers.push_back(thread([&, t] {
+                Analyzer& analyzer = analyzers[t];
+                const long long batch = 256;
+                for (long long begin = next.fetch_add(batch); begin < size; begin = next.fetch_add(batch)) {
+                    for (long long i = begin; i < min(begin + batch, size); i++) {
+                        results[i].valid = false;
+                        if (!options.inputPath.empty()) {
+                            if (!loadBoard(lines[i], analyzer.scratch, analyzer.board)) { continue; }
+                        }
+                        else {
+                            generateBoard(options, chunkStart + i, analyzer.scratch, analyzer.board);
+                        }
+                        analyzer.analyze(results[i]);
+                    }
+                }
+            }));
+        }
+        for (thread& worker : workers) {
+            worker.join();
+        }
+
+        // Write the chunk out in order
+        buffer.clear();
+        for (long long i = 0; i < size; i++) {
+            if (results[i].valid) {
+                writeRow(buffer, chunkStart + i, results[i]);
+            }
+            else if (!lines[i].empty()) {
+                cerr << "Skipping malformed board on line " << (chunkStart + i + 1) << "\n";
+            }
+        }
+        out << buffer;
+        chunkStart += size;
+    }
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+//
+//  Board.cpp
+//  minesweeper
+//
+
+#include "Board.hpp"
+using namespace std;
+
+// Randomly place mines in board
+void placeMines(vector<vector<Cell>>& board, int width, int height, int numMines, mt19937& gen) {
+    uniform_int_distribution<> distr1(0, width - 1);
+    uniform_int_distribution<> distr2(0, height - 1);
+    for (int i = 0; i < numMines; i++) {
+        int randVal1 = distr1(gen);
+        int randVal2 = distr2(gen);
+        if (!board[randVal1][randVal2].getHasMine()) {
+            board[randVal1][randVal2].setHasMine(true);
+        }
+        // If cell already contains a mine, regenerate random coords
+        else {
+            i -= 1;
+        }
+    }
+}
+
+// Iterate through cells, labelling each with the number of adjacent mines
+// Cells containing a mine are labelled 0, so a mine moved onto a numbered cell doesn't keep its old number
+void labelCells(vector<vector<Cell>>& board, int width, int height) {
+    for (int i = 0; i < width; i++) {
+        for (int j = 0; j < height; j++) {
+            int count = 0;
+            if (!board[i][j].getHasMine()) {
+                // Get current cell's neighbours
+                vector<Cell*> neighbours = getNeighbours(board, width, height, i, j);
+                
+                for (Cell* c : neighbours) {
+                    // If neighbour has mine, increment
+                    if (c->getHasMine()) { count++; };
+                }
+            }
+            board[i][j].setAdjacentNum(count);
+        }
+    }
+}
+
+// Return vector containing pointers to a cell's neighbours
+vector<Cell*> getNeighbours(vector<vector<Cell>>& board, int width, int height, int x, int y) {
+    vector<Cell*> result;
+    
+    if (x + 1 < width) {
+        result.push_back(&board[x + 1][y]);
+    }
+    if (x - 1 >= 0) {
+        result.push_back(&board[x - 1][y]);
+    }
+    if (y + 1 < height) {
+        result.push_back(&board[x][y + 1]);
+    }
+    if (y - 1 >= 0) {
+        result.push_back(&board[x][y - 1]);
+    }
+    if (x - 1 >= 0 && y + 1 < height) {
+        result.push_back(&board[x - 1][y + 1]);
+    }
+    if (x + 1 < width && y + 1 < height) {
+        result.push_back(&board[x + 1][y + 1]);
+    }
+    if (x - 1 >= 0 && y - 1 >= 0) {
+        result.push_back(&board[x - 1][y - 1]);
+    }
+    if (x + 1 < width && y - 1 >= 0) {
+        result.push_back(&board[x + 1][y - 1]);
+    }
+    
+    return result;
+}
@@ -0,0 +1,24 @@
+//
+//  Board.hpp
+//  minesweeper
+//
+
+#ifndef Board_hpp
+#define Board_hpp
+
+#include <stdio.h>
+#include <vector>
+#include <random>
+#include "Cell.hpp"
+
+// Board generation shared by the game and the board analyzer
+// Boards are indexed board[x][y] and may be larger than the width and height in use
+
+// Randomly place numMines mines in an empty board
+void placeMines(std::vector<std::vector<Cell>>& board, int width, int height, int numMines, std::mt19937& gen);
+// Label each cell with the number of adjacent mines
+void labelCells(std::vector<std::vector<Cell>>& board, int width, int height);
+// Return pointers to a cell's neighbours
+std::vector<Cell*> getNeighbours(std::vector<std::vector<Cell>>& board, int width, int height, int x, int y);
+
+#endif /* Board_hpp */
@@ -0,0 +1,421 @@
+//
+//  Probability.cpp
+//  minesweeper
+//
+
+#include "Probability.hpp"
+#include <numeric>
+#include <algorithm>
+#include <set>
+using namespace std;
+
+bool operator==(const VisibleBoard& a, const VisibleBoard& b) {
+    return a.width == b.width && a.height == b.height
+        && a.numMines == b.numMines && a.cells == b.cells;
+}
+
+// Depth first search over every mine arrangement of one frontier component
+// Cells touched by exactly the same constraints are interchangeable, so they are grouped
+// and the search picks how many mines each group holds, weighted by the ways to place them
+// Branches are pruned as soon as any constraint can no longer be satisfied
+struct Enumerator {
+    // Cells (local indices) in each group
+    vector<vector<int>> groups;
+    // Order in which groups are assigned
+    vector<int> order;
+    // Constraints touching each group
+    vector<vector<int>> groupConstraints;
+    vector<int> values;
+    // Mines placed and cells still unassigned for each constraint
+    vector<int> mines;
+    vector<int> left;
+    // Mines placed in each group
+    vector<int> assignment;
+    int mineCount = 0;
+    ComponentResult* out = nullptr;
+    const atomic<unsigned long>* generation = nullptr;
+    unsigned long gen = 0;
+    unsigned long steps = 0;
+    bool cancelled = false;
+
+    void search(size_t depth, double weight) {
+        // Check for a newer request every few thousand nodes
+        if ((++steps & 0xFFF) == 0 && *generation != gen) {
+            cancelled = true;
+        }
+        if (cancelled) { return; }
+
+        if (depth == order.size()) {
+            out->counts[mineCount] += weight;
+            for (size_t g = 0; g < groups.size(); g++) {
+                if (assignment[g] == 0) { continue; }
+                // Each cell of the group is equally likely to hold one of its mines
+                double share = weight * assignment[g] / groups[g].size();
+                for (int cell : groups[g]) {
+                    out->cellCounts[mineCount][cell] += share;
+                }
+            }
+            return;
+        }
+
+        int group = order[depth];
+        int size = int(groups[group].size());
+        // Ways of choosing t mines from the group, updated incrementally
+        double ways = 1;
+        for (int t = 0; t <= size; t++) {
+            if (t > 0) { ways = ways * (size - t + 1) / t; }
+            bool valid = true;
+            for (int c : groupConstraints[group]) {
+                left[c] -= size;
+                mines[c] += t;
+                if (mines[c] > values[c] || mines[c] + left[c] < values[c]) { valid = false; }
+            }
+            if (valid) {
+                assignment[group] = t;
+                mineCount += t;
+                search(depth + 1, weight * ways);
+                mineCount -= t;
+                assignment[group] = 0;
+            }
+            for (int c : groupConstraints[group]) {
+                left[c] += size;
+                mines[c] -= t;
+            }
+        }
+    }
+};
+
+// Return C(n, r) for every r from 0 to n
+vector<double> binomialRow(int n) {
+    vector<double> row(n + 1, 1);
+    for (int r = 1; r <= n; r++) {
+        row[r] = row[r - 1] * (n - r + 1) / r;
+    }
+    return row;
+}
+
+// Multiply two polynomials given by their coefficients
+vector<double> convolve(const vector<double>& a, const vector<double>& b) {
+    vector<double> result(a.size() + b.size() - 1, 0);
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i] == 0) { continue; }
+        for (size_t j = 0; j < b.size(); j++) {
+            result[i + j] += a[i] * b[j];
+        }
+    }
+    return result;
+}
+
+ProbabilityWorker::ProbabilityWorker() {
+    this->hasPending = false;
+    this->quit = false;
+    this->generation = 0;
+    this->hasResult = false;
+    this->worker = thread(&ProbabilityWorker::run, this);
+}
+
+ProbabilityWorker::~ProbabilityWorker() {
+    stop();
+}
+
+bool ProbabilityWorker::request(const VisibleBoard& board) {
+    lock_guard<mutex> guard(this->lock);
+    if (board == this->lastRequested) { return false; }
+    this->lastRequested = board;
+    this->pending = board;
+    this->hasPending = true;
+    // Drop any finished result for an older board that hasn't been picked up yet
+    this->hasResult = false;
+    // Any computation still running for an older board gives up at its next check
+    this->generation += 1;
+    this->wake.notify_one();
+    return true;
+}
+
+void ProbabilityWorker::reset() {
+    lock_guard<mutex> guard(this->lock);
+    this->lastRequested = VisibleBoard();
+}
+
+bool ProbabilityWorker::poll(vector<double>& out) {
+    lock_guard<mutex> guard(this->lock);
+    if (!this->hasResult) { return false; }
+    out = this->result;
+    this->hasResult = false;
+    return true;
+}
+
+void ProbabilityWorker::stop() {
+    {
+        lock_guard<mutex> guard(this->lock);
+        this->quit = true;
+        this->generation += 1;
+        this->wake.notify_one();
+    }
+    if (this->worker.joinable()) {
+        this->worker.join();
+    }
+}
+
+// Worker loop, waits for a board then computes its probabilities
+void ProbabilityWorker::run() {
+    while (true) {
+        VisibleBoard board;
+        unsigned long gen;
+        {
+            unique_lock<mutex> guard(this->lock);
+            this->wake.wait(guard, [this] { return this->hasPending || this->quit; });
+            if (this->quit) { return; }
+            board = this->pending;
+            gen = this->generation;
+            this->hasPending = false;
+        }
+
+        vector<double> out;
+        if (compute(board, gen, out)) {
+            lock_guard<mutex> guard(this->lock);
+            // Only publish if no newer board arrived while computing
+            if (gen == this->generation) {
+                this->result = out;
+                this->hasResult = true;
+            }
+        }
+    }
+}
+
+// Enumerate every arrangement of one frontier component
+// Returns false if cancelled by a newer request
+bool ProbabilityWorker::enumerate(const vector<int>& cells, const vector<vector<int>>& constraints,
+                                  const vector<int>& values, unsigned long gen, ComponentResult& out) {
+    size_t n = cells.size();
+
+    // Constraints refer to board indices, translate them to positions in cells
+    vector<vector<int>> cellConstraints(n);
+    for (size_t c = 0; c < constraints.size(); c++) {
+        for (int index : constraints[c]) {
+            int pos = int(lower_bound(cells.begin(), cells.end(), index) - cells.begin());
+            cellConstraints[pos].push_back(int(c));
+        }
+    }
+
+    // Group cells that are touched by the same constraints
+    Enumerator e;
+    map<vector<int>, int> groupOf;
+    for (size_t i = 0; i < n; i++) {
+        auto found = groupOf.find(cellConstraints[i]);
+        if (found == groupOf.end()) {
+            groupOf[cellConstraints[i]] = int(e.groups.size());
+            e.groups.push_back(vector<int>(1, int(i)));
+            e.groupConstraints.push_back(cellConstraints[i]);
+        }
+        else {
+            e.groups[found->second].push_back(int(i));
+        }
+    }
+    vector<vector<int>> constraintGroups(constraints.size());
+    for (size_t g = 0; g < e.groups.size(); g++) {
+        for (int c : e.groupConstraints[g]) {
+            constraintGroups[c].push_back(int(g));
+        }
+    }
+
+    e.values = values;
+    e.mines.assign(constraints.size(), 0);
+    e.left.assign(constraints.size(), 0);
+    for (size_t c = 0; c < constraints.size(); c++) {
+        e.left[c] = int(constraints[c].size());
+    }
+    e.assignment.assign(e.groups.size(), 0);
+    e.out = &out;
+    e.generation = &this->generation;
+    e.gen = gen;
+
+    // Assign groups in breadth first order through shared constraints
+    // so that constraints are completed (and pruned) as early as possible
+    vector<bool> queued(e.groups.size(), false);
+    queued[0] = true;
+    e.order.push_back(0);
+    for (size_t i = 0; i < e.order.size(); i++) {
+        for (int c : e.groupConstraints[e.order[i]]) {
+            for (int g : constraintGroups[c]) {
+                if (!queued[g]) {
+                    queued[g] = true;
+                    e.order.push_back(g);
+                }
+            }
+        }
+    }
+
+    out.counts.assign(n + 1, 0);
+    out.cellCounts.assign(n + 1, vector<double>(n, 0));
+    e.search(0, 1);
+    return !e.cancelled;
+}
+
+// Compute the mine probability of every cell on the board
+// out is left empty if the visible numbers are inconsistent with the mine count
+bool ProbabilityWorker::compute(const VisibleBoard& board, unsigned long gen, vector<double>& out) {
+    int width = board.width;
+    int height = board.height;
+    int numCells = width * height;
+
+    // Union find over unopened cells, joining cells that share a constraint
+    vector<int> parent(numCells);
+    iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    // Each opened number constrains its unopened neighbours
+    vector<vector<int>> constraintCells;
+    vector<int> constraintOrigins;
+    vector<bool> isFrontier(numCells, false);
+    for (int x = 0; x < width; x++) {
+        for (int y = 0; y < height; y++) {
+            int value = board.cells[(x * height) + y];
+            if (value < 0) { continue; }
+            vector<int> unknown;
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    int nx = x + dx;
+                    int ny = y + dy;
+                    if ((dx != 0 || dy != 0) && nx >= 0 && nx < width && ny >= 0 && ny < height
+                        && board.cells[(nx * height) + ny] < 0) {
+                        unknown.push_back((nx * height) + ny);
+                    }
+                }
+            }
+            if (unknown.empty()) { continue; }
+            for (int index : unknown) {
+                isFrontier[index] = true;
+                parent[find(index)] = find(unknown[0]);
+            }
+            constraintCells.push_back(unknown);
+            constraintOrigins.push_back((x * height) + y);
+        }
+    }
+
+    // Group frontier cells and constraints into independent components
+    map<int, int> componentOf;
+    vector<vector<int>> componentCells;
+    vector<vector<int>> componentConstraints;
+    int unconstrained = 0;
+    for (int i = 0; i < numCells; i++) {
+        if (board.cells[i] >= 0) { continue; }
+        if (!isFrontier[i]) {
+            unconstrained += 1;
+            continue;
+        }
+        int root = find(i);
+        if (componentOf.find(root) == componentOf.end()) {
+            componentOf[root] = int(componentCells.size());
+            componentCells.push_back(vector<int>());
+            componentConstraints.push_back(vector<int>());
+        }
+        componentCells[componentOf[root]].push_back(i);
+    }
+    for (size_t c = 0; c < constraintCells.size(); c++) {
+        componentConstraints[componentOf[find(constraintCells[c][0])]].push_back(int(c));
+    }
+
+    // Solve each component, reusing the previous result when its cells and numbers are unchanged
+    // Results go straight into the cache, so components finished before a cancellation aren't enumerated again
+    set<vector<int>> used;
+    vector<const ComponentResult*> results;
+    for (size_t k = 0; k < componentCells.size(); k++) {
+        if (this->generation != gen) { return false; }
+
+        vector<int> key = {width, height, -1};
+        key.insert(key.end(), componentCells[k].begin(), componentCells[k].end());
+        key.push_back(-1);
+        vector<vector<int>> constraints;
+        vector<int> values;
+        for (int c : componentConstraints[k]) {
+            int origin = constraintOrigins[c];
+            key.push_back(origin);
+            key.push_back(board.cells[origin]);
+            constraints.push_back(constraintCells[c]);
+            values.push_back(board.cells[origin]);
+        }
+
+        auto cached = this->cache.find(key);
+        if (cached == this->cache.end()) {
+            ComponentResult result;
+            if (!enumerate(componentCells[k], constraints, values, gen, result)) { return false; }
+            cached = this->cache.emplace(key, move(result)).first;
+        }
+        used.insert(key);
+        results.push_back(&cached->second);
+    }
+    // The pass finished, so only keep components that are still on the board
+    for (auto it = this->cache.begin(); it != this->cache.end();) {
+        if (used.count(it->first)) { ++it; }
+        else { it = this->cache.erase(it); }
+    }
+
+    // prefix[i] holds the mine count distribution of components 0 to i - 1, suffix[i] of i onwards
+    size_t numComponents = results.size();
+    vector<vector<double>> prefix(numComponents + 1, vector<double>(1, 1));
+    vector<vector<double>> suffix(numComponents + 1, vector<double>(1, 1));
+    for (size_t i = 0; i < numComponents; i++) {
+        prefix[i + 1] = convolve(prefix[i], results[i]->counts);
+    }
+    for (size_t i = numComponents; i > 0; i--) {
+        suffix[i - 1] = convolve(results[i - 1]->counts, suffix[i]);
+    }
+
+    // Ways of placing r mines among the unconstrained cells
+    int numMines = board.numMines;
+    vector<double> ways = binomialRow(unconstrained);
+    auto waysFor = [&](const vector<double>& row, int r) {
+        return (r >= 0 && r < int(row.size())) ? row[r] : 0.0;
+    };
+
+    const vector<double>& all = prefix[numComponents];
+    double total = 0;
+    for (size_t m = 0; m < all.size(); m++) {
+        total += all[m] * waysFor(ways, numMines - int(m));
+    }
+
+    out.assign(numCells, 0);
+    if (total == 0) {
+        out.clear();
+        return true;
+    }
+
+    // Frontier cells: weight each arrangement of the component by the ways the rest of the board can hold the remaining mines
+    for (size_t i = 0; i < numComponents; i++) {
+        vector<double> rest = convolve(prefix[i], suffix[i + 1]);
+        const ComponentResult& result = *results[i];
+        for (size_t m = 0; m < result.counts.size(); m++) {
+            if (result.counts[m] == 0) { continue; }
+            double weight = 0;
+            for (size_t j = 0; j < rest.size(); j++) {
+                weight += rest[j] * waysFor(ways, numMines - int(m) - int(j));
+            }
+            for (size_t c = 0; c < componentCells[i].size(); c++) {
+                out[componentCells[i][c]] += result.cellCounts[m][c] * weight / total;
+            }
+        }
+    }
+
+    // Unconstrained cells all share the same probability
+    if (unconstrained > 0) {
+        vector<double> waysWithMine = binomialRow(unconstrained - 1);
+        double weight = 0;
+        for (size_t m = 0; m < all.size(); m++) {
+            weight += all[m] * waysFor(waysWithMine, numMines - int(m) - 1);
+        }
+        for (int i = 0; i < numCells; i++) {
+            if (board.cells[i] < 0 && !isFrontier[i]) {
+                out[i] = weight / total;
+            }
+        }
+    }
+
+    return true;
+}
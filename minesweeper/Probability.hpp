@@ -0,0 +1,76 @@
+//
+//  Probability.hpp
+//  minesweeper
+//
+
+#ifndef Probability_hpp
+#define Probability_hpp
+
+#include <stdio.h>
+#include <vector>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+// What the player can see of the board
+// cells is indexed by (x * height) + y and holds the number shown on an opened cell,
+// or -1 for a cell that hasn't been opened (flags are not trusted, so flagged cells are -1 too)
+struct VisibleBoard {
+    int width = 0;
+    int height = 0;
+    int numMines = 0;
+    std::vector<int> cells;
+};
+
+bool operator==(const VisibleBoard& a, const VisibleBoard& b);
+
+// Solutions of a single frontier component, bucketed by how many mines they use
+struct ComponentResult {
+    // Number of valid mine arrangements using k mines
+    std::vector<double> counts;
+    // Number of those arrangements in which each cell of the component holds a mine
+    std::vector<std::vector<double>> cellCounts;
+};
+
+// Computes the exact mine probability of every unopened cell on a background thread
+// Each frontier component is enumerated exactly, then the components are combined
+// with the number of ways the remaining mines fit in the unconstrained cells
+class ProbabilityWorker {
+private:
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable wake;
+    // Board waiting to be picked up by the worker
+    VisibleBoard pending;
+    bool hasPending;
+    // Last board handed to the worker, used to ignore requests that change nothing
+    VisibleBoard lastRequested;
+    bool quit;
+    // Bumped on every request, computations for an older generation abandon themselves
+    std::atomic<unsigned long> generation;
+    std::vector<double> result;
+    bool hasResult;
+    // Component results keyed by cells and constraints, only touched by the worker thread
+    std::map<std::vector<int>, ComponentResult> cache;
+
+    void run();
+    bool compute(const VisibleBoard& board, unsigned long gen, std::vector<double>& out);
+    bool enumerate(const std::vector<int>& cells, const std::vector<std::vector<int>>& constraints,
+                   const std::vector<int>& values, unsigned long gen, ComponentResult& out);
+public:
+    ProbabilityWorker();
+    ~ProbabilityWorker();
+    // Cancel any computation in progress and start again on the given board
+    // Returns false if the board is the same as the last one requested
+    bool request(const VisibleBoard& board);
+    // Forget the last board requested so the next request is always accepted
+    void reset();
+    // Copy the latest finished result into out, returns false if nothing new has finished
+    bool poll(std::vector<double>& out);
+    // Stop the worker thread
+    void stop();
+};
+
+#endif /* Probability_hpp */
@@ -16,22 +16,29 @@
 #include <filesystem>
 #include <fstream>
 #include "Cell.hpp"
+#include "Board.hpp"
+#include "Assets.hpp"
+#include "Probability.hpp"
 using namespace std;
 
 // Declare functions
 void init();
+void loadAssets();
+SDL_Texture* loadTexture(const unsigned char* data, int size);
 void initBoard();
 void setupHighScore();
 void draw();
 void close();
 void renderText(char *inpText, int x, int y, SDL_Color color);
-void leftClick(int x, int y);
+vector<Cell*> leftClick(int x, int y);
+vector<Cell*> chord(int x, int y);
+vector<Cell*> revealCells(const vector<pair<int, int>>& cells);
 void rightClick(int x, int y);
 void resetBtnAction();
-vector<Cell*> getNeighbours(int x, int y);
 string secToTimeStamp(int input);
 void relocateMine();
 void labelCells();
+void requestHeatmap();
 
 // Window to render to
 SDL_Window* win = NULL;
@@ -40,6 +47,16 @@ SDL_Surface* surface = NULL;
 // Renderer object responsible for graphics rendering
 SDL_Renderer* render = NULL;
 
+// Font used for all text, opened once from the embedded font data
+TTF_Font* font = NULL;
+// Sprite textures, decoded once from the embedded bitmaps
+SDL_Texture* smileBtnTexture = NULL;
+SDL_Texture* winBtnTexture = NULL;
+SDL_Texture* deadBtnTexture = NULL;
+SDL_Texture* flagTexture = NULL;
+SDL_Texture* mineTexture = NULL;
+SDL_Texture* mineHLTexture = NULL;
+
 // Board dimensions
 int boardHeight = 16;
 int boardWidth = 30;
@@ -47,12 +64,22 @@ int boardWidth = 30;
 // Game board represented by vector of Cell objects
 vector<vector<Cell>> gameBoard (boardWidth, vector<Cell>(boardHeight));
 
+// Random number generator used for placing mines
+mt19937 generator(random_device{}());
+
 // For highlighting triggered mine
 int highlightCoords[] = {-1, -1};
 
 // For protecting first click
 bool isFirstClick;
 
+// Background worker computing mine probabilities for the heatmap overlay
+ProbabilityWorker probabilityWorker;
+// Whether the heatmap overlay is shown (toggled with H)
+bool showHeatmap = false;
+// Latest mine probability of each cell, indexed by (x * boardHeight) + y
+vector<double> heatmap;
+
 // Map of rgb values keyed by number of adjacent mines
 map<int, SDL_Color> colorMap = {
     {1, { static_cast<Uint8>(0), static_cast<Uint8>(0), static_cast<Uint8>(255) }},
@@ -111,6 +138,26 @@ void init() {
     initBoard();
 }
 
+// Create font and sprite textures from the embedded assets
+// Must be called after the renderer has been created
+void loadAssets() {
+    font = TTF_OpenFontRW(SDL_RWFromConstMem(minesweeperTtf, sizeof(minesweeperTtf)), 1, 12);
+    smileBtnTexture = loadTexture(smileBtnBmp, sizeof(smileBtnBmp));
+    winBtnTexture = loadTexture(winBtnBmp, sizeof(winBtnBmp));
+    deadBtnTexture = loadTexture(deadBtnBmp, sizeof(deadBtnBmp));
+    flagTexture = loadTexture(flagBmp, sizeof(flagBmp));
+    mineTexture = loadTexture(mineBmp, sizeof(mineBmp));
+    mineHLTexture = loadTexture(mineHLBmp, sizeof(mineHLBmp));
+}
+
+// Decode an embedded bitmap into a texture
+SDL_Texture* loadTexture(const unsigned char* data, int size) {
+    SDL_Surface* img = SDL_LoadBMP_RW(SDL_RWFromConstMem(data, size), 1);
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(render, img);
+    SDL_FreeSurface(img);
+    return texture;
+}
+
 // Read high scores into map from text file
 void setupHighScore() {
     inStream.open("highscores.txt");
@@ -118,15 +165,15 @@ void setupHighScore() {
     string text;
     
     getline(inStream, text);
-    if (text == "NA") { highScores[Difficulties::beginner] = -1; }
+    if (text == "NA" || text.empty()) { highScores[Difficulties::beginner] = -1; }
     else { highScores[Difficulties::beginner] = stoi(text); }
     
     getline(inStream, text);
-    if (text == "NA") { highScores[Difficulties::intermediate] = -1; }
+    if (text == "NA" || text.empty()) { highScores[Difficulties::intermediate] = -1; }
     else { highScores[Difficulties::intermediate] = stoi(text); }
     
     getline(inStream, text);
-    if (text == "NA") { highScores[Difficulties::expert] = -1; }
+    if (text == "NA" || text.empty()) { highScores[Difficulties::expert] = -1; }
     else { highScores[Difficulties::expert] = stoi(text); }
     
     inStream.close();
@@ -169,21 +216,7 @@ void initBoard() {
     }
     
     // Randomly place mines in board
-    for (int i = 0; i < numFlags; i++) {
-        random_device rd;
-        mt19937 gen(rd());
-        uniform_int_distribution<> distr1(0, boardWidth - 1);
-        int randVal1 = distr1(gen);
-        uniform_int_distribution<> distr2(0, boardHeight - 1);
-        int randVal2 = distr2(gen);
-        if (!gameBoard[randVal1][randVal2].getHasMine()) {
-            gameBoard[randVal1][randVal2].setHasMine(true);
-        }
-        // If cell already contains a mine, regenerate random coords
-        else {
-            i -= 1;
-        }
-    }
+    placeMines(gameBoard, boardWidth, boardHeight, numFlags, generator);
     
     // Label each cell with the number of adjacent mines
     labelCells();
@@ -192,26 +225,39 @@ void initBoard() {
     offset = currentTime;
     // Assign last time to curren time
     lastTime = floor(currentTime / 1000);
+    
+    // Probabilities of the previous game no longer apply, start computing them for the new board
+    heatmap.clear();
+    probabilityWorker.reset();
+    requestHeatmap();
 }
 
-// Iterate through cells, labelling each with the number of adjacent mines
-void labelCells() {
+// Hand what the player can currently see to the probability worker
+// The worker abandons any computation for an older board and ignores boards that haven't changed
+// If the board has changed the current probabilities are discarded, so no tint is drawn until the new ones arrive
+void requestHeatmap() {
+    if (!showHeatmap) { return; }
+    
+    VisibleBoard board;
+    board.width = boardWidth;
+    board.height = boardHeight;
+    board.numMines = numFlags;
+    board.cells.assign(boardWidth * boardHeight, -1);
     for (int i = 0; i < boardWidth; i++) {
         for (int j = 0; j < boardHeight; j++) {
-            int count = 0;
-            if (!gameBoard[i][j].getHasMine()) {
-                // Get current cell's neighbours
-                vector<Cell*> neighbours = getNeighbours(i, j);
-                
-                for (Cell* c : neighbours) {
-                    // If neighbour has mine, increment
-                    if (c->getHasMine()) { count++; };
-                }
-                
-                gameBoard[i][j].setAdjacentNum(count);
+            if (gameBoard[i][j].getState() == CellState::opened && !gameBoard[i][j].getHasMine()) {
+                board.cells[(i * boardHeight) + j] = gameBoard[i][j].getAdjacentNum();
             }
         }
     }
+    if (probabilityWorker.request(board)) {
+        heatmap.clear();
+    }
+}
+
+// Label each cell of the game board with the number of adjacent mines
+void labelCells() {
+    labelCells(gameBoard, boardWidth, boardHeight);
 }
 
 // Convert milliseconds into timestamp string
@@ -239,89 +285,105 @@ string secToTimeStamp(int input) {
     }
 }
 
-// Return vector containing pointers to a cell's neighbours
-vector<Cell*> getNeighbours(int x, int y) {
-    vector<Cell*> result;
-    
-    if (x + 1 < boardWidth) {
-        result.push_back(&gameBoard[x + 1][y]);
-    }
-    if (x - 1 >= 0) {
-        result.push_back(&gameBoard[x - 1][y]);
-    }
-    if (y + 1 < boardHeight) {
-        result.push_back(&gameBoard[x][y + 1]);
-    }
-    if (y - 1 >= 0) {
-        result.push_back(&gameBoard[x][y - 1]);
-    }
-    if (x - 1 >= 0 && y + 1 < boardHeight) {
-        result.push_back(&gameBoard[x - 1][y + 1]);
-    }
-    if (x + 1 < boardWidth && y + 1 < boardHeight) {
-        result.push_back(&gameBoard[x + 1][y + 1]);
+// Function called when user left clicks
+// Takes as parameters the coordinates for the cell clicked on
+// Returns the cells that were changed
+vector<Cell*> leftClick(int x, int y) {
+    return revealCells({{x, y}});
+}
+
+// Function called when user middle clicks or presses left and right together
+// If the number on an opened cell matches the flags around it, open all of its other neighbours
+// Returns the cells that were changed
+vector<Cell*> chord(int x, int y) {
+    if (x < 0 || x >= boardWidth || y < 0 || y >= boardHeight
+        || gameBoard[x][y].getState() != CellState::opened || gameBoard[x][y].getAdjacentNum() == 0) {
+        return {};
     }
-    if (x - 1 >= 0 && y - 1 >= 0) {
-        result.push_back(&gameBoard[x - 1][y - 1]);
+    
+    vector<pair<int, int>> toOpen;
+    int flags = 0;
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            if ((dx != 0 || dy != 0) && x + dx >= 0 && x + dx < boardWidth && y + dy >= 0 && y + dy < boardHeight) {
+                if (gameBoard[x + dx][y + dy].getState() == CellState::flagged) { flags++; }
+                else if (gameBoard[x + dx][y + dy].getState() == CellState::unopened) { toOpen.push_back({x + dx, y + dy}); }
+            }
+        }
     }
-    if (x + 1 < boardWidth && y - 1 >= 0) {
-        result.push_back(&gameBoard[x + 1][y - 1]);
+    if (flags != gameBoard[x][y].getAdjacentNum()) {
+        return {};
     }
-    
-    return result;
+    return revealCells(toOpen);
 }
 
-// Function called when user left clicks
-// Takes as parameters the coordinates for the cell clicked on
-void leftClick(int x, int y) {
-    // Check if click was within range of game board and was on a non-flagged cell
-    if (x >= 0 && x < boardWidth && y >= 0 && y < boardHeight
-        && gameBoard[x][y].getState() != CellState::flagged) {
+// Open a batch of cells in one pass, e.g. a click, a chord or a list of cells known to be safe
+// Flagged, opened and out of range cells are skipped
+// Cells with no adjacent mines uncover their neighbours, continuing until reaching squares with adjacent mines
+// A cell reached from several starting cells is only opened once
+// Returns every cell whose state changed so the renderer can work from a single diff
+vector<Cell*> revealCells(const vector<pair<int, int>>& cells) {
+    vector<Cell*> changed;
+    // Cells waiting to be opened by the flood fill
+    vector<Cell*> stack;
+    
+    for (auto [x, y] : cells) {
+        // Check cell is within range of game board and is unopened
+        if (status != GameStatus::alive || x < 0 || x >= boardWidth || y < 0 || y >= boardHeight
+            || gameBoard[x][y].getState() != CellState::unopened) {
+            continue;
+        }
         // Procedure for protecting first move
+        // Mine is relocated before being removed so it can't land back on the clicked cell
         if (isFirstClick && gameBoard[x][y].getHasMine()) {
-            gameBoard[x][y].setHasMine(false);
             relocateMine();
+            gameBoard[x][y].setHasMine(false);
             labelCells();
         }
         isFirstClick = false;
         
-        if (status == GameStatus::alive) {
-            // Open clicked on cell
-            gameBoard[x][y].setState(CellState::opened);
-            
-            if (gameBoard[x][y].getHasMine()) {
-                // If user clicked on mine, highlight that cell
-                highlightCoords[0] = x; highlightCoords[1] = y;
-                // Change status to dead
-                status = GameStatus::dead;
-                // Uncover all mines
-                for (int i = 0; i < boardWidth; i++) {
-                    for (int j = 0; j < boardHeight; j++) {
-                        if (gameBoard[i][j].getHasMine()) {
-                            gameBoard[i][j].setState(CellState::opened);
-                        }
+        if (gameBoard[x][y].getHasMine()) {
+            // If user opened a mine, highlight that cell
+            highlightCoords[0] = x; highlightCoords[1] = y;
+            // Change status to dead
+            status = GameStatus::dead;
+            // Uncover all mines
+            for (int i = 0; i < boardWidth; i++) {
+                for (int j = 0; j < boardHeight; j++) {
+                    if (gameBoard[i][j].getHasMine() && gameBoard[i][j].getState() != CellState::opened) {
+                        gameBoard[i][j].setState(CellState::opened);
+                        changed.push_back(&gameBoard[i][j]);
                     }
                 }
             }
+            return changed;
+        }
+        
+        stack.push_back(&gameBoard[x][y]);
+        while (!stack.empty()) {
+            Cell* c = stack.back();
+            stack.pop_back();
+            if (c->getState() != CellState::unopened) { continue; }
+            c->setState(CellState::opened);
+            changed.push_back(c);
             
-            // If clicked on cell has no adjacent mines uncover neighbours with no neighbouring mines
-            // Continue recursively until reaching squares with adjacent mines
-            else if (gameBoard[x][y].getAdjacentNum() == 0) {
-                vector<Cell*> neighbours = getNeighbours(x, y);
-                for (Cell* c : neighbours) {
-                    if (c->getState() == CellState::unopened
-                        && !c->getHasMine()) {
-                        if (c->getAdjacentNum() == 0) {
-                            leftClick(c->getRow(), c->getCol());
-                        }
-                        else {
-                            c->setState(CellState::opened);
+            if (c->getAdjacentNum() == 0) {
+                int i = c->getRow();
+                int j = c->getCol();
+                for (int dx = -1; dx <= 1; dx++) {
+                    for (int dy = -1; dy <= 1; dy++) {
+                        if (i + dx >= 0 && i + dx < boardWidth && j + dy >= 0 && j + dy < boardHeight
+                            && gameBoard[i + dx][j + dy].getState() == CellState::unopened
+                            && !gameBoard[i + dx][j + dy].getHasMine()) {
+                            stack.push_back(&gameBoard[i + dx][j + dy]);
                         }
                     }
                 }
             }
         }
     }
+    
+    return changed;
 }
 
 // Called if user triggers a mine on their first click
@@ -388,17 +450,16 @@ void draw() {
     
     // Draw top button
     // Image changes according to game status
-    SDL_Surface* btnImg;
+    SDL_Texture* btnTexture;
     if (status == GameStatus::alive) {
-        btnImg = SDL_LoadBMP("smilebtn.bmp");
+        btnTexture = smileBtnTexture;
     }
     else if (status == GameStatus::complete) {
-        btnImg = SDL_LoadBMP("winbtn.bmp");
+        btnTexture = winBtnTexture;
     }
     else {
-        btnImg = SDL_LoadBMP("deadbtn.bmp");
+        btnTexture = deadBtnTexture;
     }
-    SDL_Texture* btnTexture = SDL_CreateTextureFromSurface(render, btnImg);
     r.x = (20 * boardWidth)/2; r.y = 20; r.w = 20; r.h = 20;
     SDL_RenderCopy(render, btnTexture, NULL, &r);
     SDL_SetRenderDrawColor(render, 150, 150, 150, 255);
@@ -462,11 +523,18 @@ void draw() {
                 r.x = 11 + (i * 20); r.y = 61 + (j * 20);
                 r.w = 19; r.h = 19;
                 SDL_RenderFillRect(render, &r);
+                // Tint by mine probability, from green (safe) to red (certain mine)
+                if (showHeatmap && status == GameStatus::alive
+                    && heatmap.size() == static_cast<size_t>(boardWidth * boardHeight)) {
+                    double p = heatmap[(i * boardHeight) + j];
+                    SDL_SetRenderDrawBlendMode(render, SDL_BLENDMODE_BLEND);
+                    SDL_SetRenderDrawColor(render, static_cast<Uint8>(255 * p), static_cast<Uint8>(255 * (1 - p)), 0, 110);
+                    SDL_RenderFillRect(render, &r);
+                    SDL_SetRenderDrawBlendMode(render, SDL_BLENDMODE_NONE);
+                }
             }
             // If cell is flagged, draw flag sprite
             else if (gameBoard[i][j].getState() == CellState::flagged) {
-                SDL_Surface* flagImg = SDL_LoadBMP("flag.bmp");
-                SDL_Texture* flagTexture = SDL_CreateTextureFromSurface(render, flagImg);
                 r.x = 11 + (i * 20); r.y = 61 + (j * 20); r.w = 19; r.h = 19;
                 SDL_RenderCopy(render, flagTexture, NULL, &r);
             }
@@ -481,16 +549,15 @@ void draw() {
                 }
                 // If cell contains a mine, draw mine sprite
                 else if (gameBoard[i][j].getHasMine()) {
-                    SDL_Surface* mineImg;
+                    SDL_Texture* texture;
                     if (i == highlightCoords[0] && j == highlightCoords[1]) {
-                        mineImg = SDL_LoadBMP("mineHL.bmp");
+                        texture = mineHLTexture;
                     }
                     else {
-                        mineImg = SDL_LoadBMP("mine.bmp");
+                        texture = mineTexture;
                     }
-                    SDL_Texture* mineTexture = SDL_CreateTextureFromSurface(render, mineImg);
                     r.x = 11 + (i * 20); r.y = 61 + (j * 20); r.w = 19; r.h = 19;
-                    SDL_RenderCopy(render, mineTexture, NULL, &r);
+                    SDL_RenderCopy(render, texture, NULL, &r);
                 }
             }
         }
@@ -514,7 +581,6 @@ void draw() {
 
 // Function for rendering text
 void renderText(char *inpText, int x, int y, SDL_Color color) {
-    TTF_Font *font = TTF_OpenFont("minesweeper.ttf", 12);
     SDL_Surface* textSurface = TTF_RenderText_Solid(font, inpText, color);
     SDL_Texture* text = SDL_CreateTextureFromSurface(render, textSurface);
     SDL_Rect r;
@@ -527,11 +593,19 @@ void renderText(char *inpText, int x, int y, SDL_Color color) {
     // Free up resources
     SDL_DestroyTexture(text);
     SDL_FreeSurface(textSurface);
-    TTF_CloseFont(font);
 }
 
 // Free resources and close SDL + SDL_TTF
 void close() {
+    probabilityWorker.stop();
+    SDL_DestroyTexture(smileBtnTexture);
+    SDL_DestroyTexture(winBtnTexture);
+    SDL_DestroyTexture(deadBtnTexture);
+    SDL_DestroyTexture(flagTexture);
+    SDL_DestroyTexture(mineTexture);
+    SDL_DestroyTexture(mineHLTexture);
+    TTF_CloseFont(font);
+    SDL_DestroyRenderer(render);
     SDL_DestroyWindow(win);
     TTF_Quit();
     SDL_Quit();
@@ -543,6 +617,8 @@ int main() {
     init();
     // Create renderer
     render = SDL_CreateRenderer(win, -1, SDL_RENDERER_ACCELERATED);
+    // Decode font and sprites once up front
+    loadAssets();
     
     // Render first frame
     draw();
@@ -558,6 +634,10 @@ int main() {
             draw();
             lastTime = currentTime;
         }
+        // Re-render window when the probability worker finishes
+        if (showHeatmap && probabilityWorker.poll(heatmap)) {
+            draw();
+        }
         
         // Event handling
         if (SDL_PollEvent(&event)) {
@@ -565,8 +645,16 @@ int main() {
             if (event.type == SDL_QUIT) {
                 isQuit = true;
             }
+            // Toggle probability heatmap
+            else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_h) {
+                showHeatmap = !showHeatmap;
+                requestHeatmap();
+                draw();
+            }
             // Handle muse click
             else if (event.type == SDL_MOUSEBUTTONDOWN) {
+                // Cells opened by this click
+                vector<Cell*> changed;
                 // Handle left mouse click
                 if (event.button.button == SDL_BUTTON_LEFT) {
                     // If top button is clicked, call relevant function
@@ -597,16 +685,38 @@ int main() {
                         currentDifficulty = Difficulties::expert;
                         initBoard();
                     }
+                    // If right button is already held, chord
+                    else if (SDL_GetMouseState(NULL, NULL) & SDL_BUTTON_RMASK) {
+                        changed = chord(floor((event.motion.x - 10) / 20), floor((event.motion.y - 60) / 20));
+                    }
                     // Otherwise, call usual leftClick
                     else {
-                        leftClick(floor((event.motion.x - 10) / 20), floor((event.motion.y - 60) / 20));
+                        changed = leftClick(floor((event.motion.x - 10) / 20), floor((event.motion.y - 60) / 20));
                     }
                     // Re-render window
                     draw();
                 }
                 // Handle right mouse click
                 else if (event.button.button == SDL_BUTTON_RIGHT) {
-                    rightClick(floor((event.motion.x - 10) / 20), floor((event.motion.y - 60) / 20));
+                    // If left button is already held, chord
+                    if (SDL_GetMouseState(NULL, NULL) & SDL_BUTTON_LMASK) {
+                        changed = chord(floor((event.motion.x - 10) / 20), floor((event.motion.y - 60) / 20));
+                        if (!changed.empty()) { draw(); }
+                    }
+                    else {
+                        rightClick(floor((event.motion.x - 10) / 20), floor((event.motion.y - 60) / 20));
+                        requestHeatmap();
+                    }
+                }
+                // Handle middle mouse click
+                else if (event.button.button == SDL_BUTTON_MIDDLE) {
+                    changed = chord(floor((event.motion.x - 10) / 20), floor((event.motion.y - 60) / 20));
+                    if (!changed.empty()) { draw(); }
+                }
+                
+                // Recompute probabilities if any cells were opened
+                if (!changed.empty()) {
+                    requestHeatmap();
                 }
                 
                 // Check for game completion
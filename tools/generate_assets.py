@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+# Regenerates minesweeper/Assets.hpp from the font and sprites in minesweeper/assets/
+# Run from anywhere: python3 tools/generate_assets.py
+
+import os
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "minesweeper")
+
+# Asset file and the name of the array it is embedded as
+ASSETS = [
+    ("minesweeper.ttf", "minesweeperTtf"),
+    ("smilebtn.bmp", "smileBtnBmp"),
+    ("winbtn.bmp", "winBtnBmp"),
+    ("deadbtn.bmp", "deadBtnBmp"),
+    ("flag.bmp", "flagBmp"),
+    ("mine.bmp", "mineBmp"),
+    ("mineHL.bmp", "mineHLBmp"),
+]
+
+HEADER = """//
+//  Assets.hpp
+//  minesweeper
+//
+
+// Font and sprites compiled into the executable so that nothing has to be read
+// from the working directory at startup
+// Generated by tools/generate_assets.py from the files in assets/, do not edit by hand
+
+#ifndef Assets_hpp
+#define Assets_hpp
+"""
+
+
+def main():
+    lines = [HEADER]
+    for path, name in ASSETS:
+        with open(os.path.join(ROOT, "assets", path), "rb") as f:
+            data = f.read()
+        lines.append("// assets/%s" % path)
+        lines.append("inline constexpr unsigned char %s[] = {" % name)
+        for i in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+        lines.append("};\n")
+    lines.append("#endif /* Assets_hpp */")
+    with open(os.path.join(ROOT, "Assets.hpp"), "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()